@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+// GrooveMeterSubsystem.cpp
+#include "GrooveMeterSubsystem.h"
+#include "NewSynthComponent.h"
+
+void UGrooveMeterSubsystem::RegisterBridge(UNewSynthComponent* Bridge)
+{
+	if (Bridge) Bridges.AddUnique(Bridge);
+}
+
+void UGrooveMeterSubsystem::UnregisterBridge(UNewSynthComponent* Bridge)
+{
+	Bridges.Remove(Bridge);
+}
+
+void UGrooveMeterSubsystem::Tick(float DeltaTime)
+{
+	// Rate limit: accumulate time and only push when the interval has elapsed
+	if (UpdateRateHz > 0.f)
+	{
+		const float Interval = 1.f / UpdateRateHz;
+		TimeSinceUpdate += DeltaTime;
+		if (TimeSinceUpdate < Interval) return;
+		// Keep the remainder so the average rate is exact (40 Hz at 60 fps stays 40 Hz),
+		// but cap it so a long hitch doesn't cause a burst of catch-up updates.
+		TimeSinceUpdate = FMath::Min(TimeSinceUpdate - Interval, Interval);
+	}
+
+	// Read every groove once, then fan out to all bridges listening to it.
+	// Bridges sharing a collection, groove, prefix and gain make one set of MPC writes.
+	FrameCache.Reset();
+	CollectionWrites.Reset();
+	for (int32 i = Bridges.Num() - 1; i >= 0; --i)
+	{
+		UNewSynthComponent* Bridge = Bridges[i].Get();
+		if (!Bridge) { Bridges.RemoveAtSwap(i); continue; }  // destroyed without EndPlay
+		if (!IsValid(Bridge->Groove)) continue;              // unset or being destroyed
+
+		const FGrooveMeterFrame* Frame = FrameCache.Find(Bridge->Groove);
+		if (!Frame) Frame = &FrameCache.Add(Bridge->Groove, Bridge->Groove->GetMeters());
+
+		const UNewSynthComponent::FCollectionWriteKey Key = Bridge->GetCollectionWriteKey();
+		bool bAlreadyWritten = false;
+		if (Key.Get<0>()) CollectionWrites.Add(Key, &bAlreadyWritten);
+		Bridge->PushMeters(*Frame, !bAlreadyWritten);
+	}
+}
+
+TStatId UGrooveMeterSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGrooveMeterSubsystem, STATGROUP_Tickables);
+}
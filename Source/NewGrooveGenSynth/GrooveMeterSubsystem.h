@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+// GrooveMeterSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GrooveSynthComponent.h"  // FGrooveMeterFrame
+#include "NewSynthComponent.h"     // UNewSynthComponent::FCollectionWriteKey
+#include "GrooveMeterSubsystem.generated.h"
+
+/**
+ * UGrooveMeterSubsystem
+ * ---------------------
+ * Central manager for meter bridges (UNewSynthComponent).
+ * - One game-thread tick per world instead of one per visualizer.
+ * - Each groove's atomics are read once per update, however many bridges listen to it.
+ * - Bridges that would write identical MPC scalars share one set of writes.
+ * - Only ticks while at least one bridge is registered.
+ * - Default rate is a project setting in DefaultGame.ini:
+ *     [/Script/NewGrooveGenSynth.GrooveMeterSubsystem]
+ *     UpdateRateHz=30
+ */
+UCLASS(config=Game)
+class NEWGROOVEGENSYNTH_API UGrooveMeterSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void RegisterBridge(UNewSynthComponent* Bridge);
+	void UnregisterBridge(UNewSynthComponent* Bridge);
+
+	/** Override the configured rate for this world. Hz <= 0 = every frame. */
+	UFUNCTION(BlueprintCallable, Category="ProcAudio")
+	void SetUpdateRate(float Hz) { UpdateRateHz = FMath::Max(0.f, Hz); }
+	UFUNCTION(BlueprintCallable, Category="ProcAudio")
+	float GetUpdateRate() const { return UpdateRateHz; }
+
+	// ---- FTickableGameObject ----
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Bridges.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	TArray<TWeakObjectPtr<UNewSynthComponent>> Bridges;
+
+	// Scratch map reused every update (avoids reallocating per frame)
+	TMap<const UGrooveSynthComponent*, FGrooveMeterFrame> FrameCache;
+	// (collection instance, groove, first param name, gain) already written this update
+	TSet<UNewSynthComponent::FCollectionWriteKey> CollectionWrites;
+
+	/** Updates per second. 0 = every frame (default). Read from config on world creation. */
+	UPROPERTY(config)
+	float UpdateRateHz = 0.f;
+	float TimeSinceUpdate = 0.f;
+};
@@ -29,6 +29,58 @@ void UGrooveSynthComponent::SetMotionAmount(float Normalized01)
     Motion = FMath::Clamp(Normalized01, 0.f, 1.f);
 }
 
+FGrooveMeterFrame UGrooveSynthComponent::GetMeters() const
+{
+	// Relaxed is enough: each meter is independent and only drives visuals.
+	FGrooveMeterFrame F;
+	F.RMS     = AnRMS.load(std::memory_order_relaxed);
+	F.ArpEnv  = AnArpEnv.load(std::memory_order_relaxed);
+	F.PadEnv  = AnPadEnv.load(std::memory_order_relaxed);
+	F.PercEnv = AnPercEnv.load(std::memory_order_relaxed);
+	F.Bass    = AnBass.load(std::memory_order_relaxed);
+	F.Mid     = AnMid.load(std::memory_order_relaxed);
+	F.Treble  = AnTreble.load(std::memory_order_relaxed);
+	return F;
+}
+
+bool UGrooveSynthComponent::GetSnapshot(FGrooveGeneratorSnapshot& OutSnapshot) const
+{
+	FScopeLock Lock(&SnapshotLock);
+	OutSnapshot = Snapshot;
+	return Snapshot.IsValid();
+}
+
+void UGrooveSynthComponent::SetSnapshot(const FGrooveGeneratorSnapshot& InSnapshot)
+{
+	FScopeLock Lock(&SnapshotLock);
+	Snapshot = InSnapshot;
+	bSnapshotOverride = true;   // the running generator must not overwrite this
+}
+
+void UGrooveSynthComponent::ClearSnapshot()
+{
+	FScopeLock Lock(&SnapshotLock);
+	Snapshot = FGrooveGeneratorSnapshot();
+	bSnapshotOverride = true;
+}
+
+void UGrooveSynthComponent::BeginPlay()
+{
+	// Coming back from a save / streaming: seed the first generator with the stored state
+	if (bResumeFromSnapshot && SavedSnapshot.IsValid()) SetSnapshot(SavedSnapshot);
+	Super::BeginPlay();
+}
+
+void UGrooveSynthComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Leaving the world (streaming out, destroyed): keep the last state for SaveGame / listeners
+	if (bResumeFromSnapshot && GetSnapshot(SavedSnapshot))
+	{
+		OnSnapshotCaptured.Broadcast(SavedSnapshot);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
 // ============================================================================
 // Audio Generator (runs on Unreal's audio render thread)
 // ============================================================================
@@ -77,15 +129,37 @@ public:
     		bPercOn    = C->bPercOn;
     	}
 
-    	// Initialize musical state
-    	Rng.Initialize(SeedShadow);
-    	RebuildScale();
-    	UpdateTiming();
-
     	// Different character for each voice
     	// Give the two voices different feels
     	Arp.A=0.08; Arp.D=0.10; Arp.S=0.30; Arp.R=0.20; Arp.Pan=-0.2f;
     	Pad.A=0.20; Pad.D=0.50; Pad.S=0.60; Pad.R=0.80; Pad.Pan=+0.2f;
+
+    	// Claim publishing rights and continue from a stored snapshot if there is one, else start fresh
+    	FGrooveGeneratorSnapshot Snap;
+    	bool bRestore = false;
+    	if (auto* C = Owner.Get())
+    	{
+    		FScopeLock Lock(&C->SnapshotLock);
+    		Generation = ++C->SnapshotGeneration;   // older generators stop publishing
+    		// An explicit SetSnapshot always applies, even with bResumeFromSnapshot off
+    		if ((C->bResumeFromSnapshot || C->bSnapshotOverride) && C->Snapshot.IsValid())
+    		{
+    			Snap = C->Snapshot;
+    			bRestore = true;
+    		}
+    		C->bSnapshotOverride = false;            // explicit Set/Clear is consumed here
+    	}
+    	if (bRestore)
+    	{
+    		RestoreSnapshot(Snap);
+    	}
+    	else
+    	{
+    		// Initialize musical state
+    		Rng.Initialize(SeedShadow);
+    		RebuildScale();
+    		UpdateTiming();
+    	}
     }
 
 	// Mixer asks for NumSamples interleaved float samples. Return count written.
@@ -176,6 +250,17 @@ public:
     		C->AnBass.store(    (1 - kMeterSmoothing) * C->AnBass.load()    + kMeterSmoothing * FMath::Abs(LP) );
     		C->AnMid.store(     (1 - kMeterSmoothing) * C->AnMid.load()     + kMeterSmoothing * FMath::Abs(BP) );
     		C->AnTreble.store(  (1 - kMeterSmoothing) * C->AnTreble.load()  + kMeterSmoothing * FMath::Abs(HP) );
+
+    		// Publish state for the next generator; never block the audio thread on it.
+    		// Skipped if a newer generator exists or Set/ClearSnapshot is pending.
+    		if (C->bResumeFromSnapshot && C->SnapshotLock.TryLock())
+    		{
+    			if (C->SnapshotGeneration == Generation && !C->bSnapshotOverride)
+    			{
+    				CaptureSnapshot(C->Snapshot);
+    			}
+    			C->SnapshotLock.Unlock();
+    		}
     	}
 
     	return NumSamples;
@@ -197,8 +282,17 @@ private:
 	// Soft saturation (cubic) to tame peaks
 	static float  SoftClip(float x) { return FMath::Clamp(x - (x*x*x)/3.f, -1.f, 1.f); }
 
-	// Build the semitone offsets for the current scale
+	// Build the semitone offsets for the current scale and pick a new walker position
 	void RebuildScale()
+	{
+		FillScaleSemis();
+		// Start walker somewhere in the scale
+
+		Walker = ScaleSemis.Num() ? Rng.RandRange(0, ScaleSemis.Num()-1) : 0;
+	}
+
+	// Semitone offsets only (no RNG use, so restoring a snapshot stays in phase)
+	void FillScaleSemis()
 	{
 		ScaleSemis.Reset();
 		switch (Scale)
@@ -208,9 +302,6 @@ private:
 			case EProcScale::MinorPentatonic: ScaleSemis = {0,3,5,7,10};      break;
 			case EProcScale::HarmonicMinor:   ScaleSemis = {0,2,3,5,7,8,11};  break;
 		}
-		// Start walker somewhere in the scale
-
-		Walker = ScaleSemis.Num() ? Rng.RandRange(0, ScaleSemis.Num()-1) : 0;
 	}
 
 	// Recompute sample counts for musical periods from BPM
@@ -230,6 +321,54 @@ private:
 		if (ScaleShadow != Scale) { ScaleShadow = Scale; RebuildScale(); }
 	}
 
+	// Copy everything that evolves over time into a snapshot
+	void CaptureSnapshot(FGrooveGeneratorSnapshot& S) const
+	{
+		S.SampleRate = SampleRate;
+		S.Sixteenth = Sixteenth; S.Eighth = Eighth; S.PadGate = PadGate;
+		S.Walker = Walker;
+		S.RngState = Rng.GetCurrentSeed();
+		S.SeedShadow = SeedShadow;
+		CaptureVoice(Arp, S.Arp);
+		CaptureVoice(Pad, S.Pad);
+		S.PercEnv = PercEnv;
+		S.LP = LP; S.BP = BP; S.HP = HP; S.ReverbL = ReverbL; S.ReverbR = ReverbR;
+	}
+
+	// Inverse of CaptureSnapshot. Parameters (BPM, Scale, ...) already come from the
+	// component, so derived state is rebuilt without consuming RNG.
+	void RestoreSnapshot(const FGrooveGeneratorSnapshot& S)
+	{
+		// Clocks and envelope times are sample counts; rescale if the device rate changed
+		const double RateScale = static_cast<double>(SampleRate) / S.SampleRate;
+
+		SeedShadow = S.SeedShadow;
+		Rng.Initialize(S.RngState);
+		FillScaleSemis();
+		Walker = FMath::Clamp(S.Walker, 0, FMath::Max(0, ScaleSemis.Num()-1));
+		UpdateTiming();
+		BPMShadow = BPM; ScaleShadow = Scale;  // derived state is current
+
+		Sixteenth = FMath::Fmod(S.Sixteenth * RateScale, SixteenthPeriod);
+		Eighth    = FMath::Fmod(S.Eighth    * RateScale, EighthPeriod);
+		PadGate   = FMath::Fmod(S.PadGate   * RateScale, PadPeriod);
+
+		RestoreVoice(S.Arp, Arp, RateScale);
+		RestoreVoice(S.Pad, Pad, RateScale);
+		PercEnv = S.PercEnv;
+		LP = S.LP; BP = S.BP; HP = S.HP; ReverbL = S.ReverbL; ReverbR = S.ReverbR;
+	}
+
+	static void CaptureVoice(const FGrooveVoice& V, FGrooveVoiceSnapshot& S)
+	{
+		S.Phase = V.Phase; S.Phase2 = V.Phase2; S.Freq = V.Freq; S.Env = V.Env; S.EnvTime = V.EnvTime;
+	}
+
+	static void RestoreVoice(const FGrooveVoiceSnapshot& S, FGrooveVoice& V, double RateScale)
+	{
+		V.Phase = S.Phase; V.Phase2 = S.Phase2; V.Freq = S.Freq; V.Env = S.Env; V.EnvTime = S.EnvTime * RateScale;
+	}
+
 	// Arpeggio trigger on sixteenth grid
 	void TriggerArp()
 	{
@@ -335,6 +474,9 @@ private:
 
 	// meters/fx Simple analysis state + tiny feedback delay
 	float LP=0, BP=0, HP=0, ReverbL=0, ReverbR=0;
+
+	// Which generator of the owner this is (see UGrooveSynthComponent::SnapshotGeneration)
+	uint32 Generation=0;
 };
 
 // ============================================================================
@@ -348,3 +490,8 @@ ISoundGeneratorPtr UGrooveSynthComponent::CreateSoundGenerator(const FSoundGener
     return MakeShared<FGrooveSoundGenerator, ESPMode::ThreadSafe>(InParams, this);
 }
 
+ISoundGeneratorPtr UGrooveSynthComponent::CreateOfflineGenerator(const FSoundGeneratorInitParams& InParams)
+{
+	// Same generator the mixer gets; the caller pulls blocks via OnGenerateAudio itself.
+	return CreateSoundGenerator(InParams);
+}
@@ -25,6 +25,72 @@ enum class EProcScale : uint8
     HarmonicMinor
 };
 
+// ---------- One frame of meter values (copied out of the atomics) ----------
+// Plain value snapshot so consumers read the atomics once and pass this around.
+USTRUCT(BlueprintType)
+struct FGrooveMeterFrame
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "ProcAudio") float RMS = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "ProcAudio") float ArpEnv = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "ProcAudio") float PadEnv = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "ProcAudio") float PercEnv = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "ProcAudio") float Bass = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "ProcAudio") float Mid = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "ProcAudio") float Treble = 0.f;
+};
+
+// ---------- Generator state snapshot (restart / streaming / pre-warm) ----------
+// Plain copyable data; opaque to Blueprints, but can be stored and handed back.
+// Fields are SaveGame so it is written by SaveGame serialization. Level streaming does
+// not do that: to carry state across streaming, store it from OnSnapshotCaptured.
+USTRUCT()
+struct FGrooveVoiceSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY(SaveGame) double Phase = 0.0;
+	UPROPERTY(SaveGame) double Phase2 = 0.0;
+	UPROPERTY(SaveGame) double Freq = 220.0;
+	UPROPERTY(SaveGame) double Env = 0.0;
+	UPROPERTY(SaveGame) double EnvTime = 0.0;   // in samples at SampleRate
+};
+
+USTRUCT(BlueprintType)
+struct FGrooveGeneratorSnapshot
+{
+	GENERATED_BODY()
+
+	// Rate the clocks/envelope times were counted at (0 = empty snapshot)
+	UPROPERTY(SaveGame) int32 SampleRate = 0;
+
+	// Rhythmic clocks (samples into the current period)
+	UPROPERTY(SaveGame) double Sixteenth = 0.0;
+	UPROPERTY(SaveGame) double Eighth = 0.0;
+	UPROPERTY(SaveGame) double PadGate = 0.0;
+
+	// Musical state
+	UPROPERTY(SaveGame) int32 Walker = 0;
+	UPROPERTY(SaveGame) int32 RngState = 0;     // FRandomStream current seed (its whole state)
+	UPROPERTY(SaveGame) int32 SeedShadow = 0;   // seed the RNG was last initialized from
+	UPROPERTY(SaveGame) FGrooveVoiceSnapshot Arp;
+	UPROPERTY(SaveGame) FGrooveVoiceSnapshot Pad;
+	UPROPERTY(SaveGame) float PercEnv = 0.f;
+
+	// Analysis filters + feedback echo
+	UPROPERTY(SaveGame) float LP = 0.f;
+	UPROPERTY(SaveGame) float BP = 0.f;
+	UPROPERTY(SaveGame) float HP = 0.f;
+	UPROPERTY(SaveGame) float ReverbL = 0.f;
+	UPROPERTY(SaveGame) float ReverbR = 0.f;
+
+	bool IsValid() const { return SampleRate > 0; }
+};
+
+// Fired from EndPlay (level streaming out, actor destroyed) with the last published state
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGrooveSnapshotCaptured, const FGrooveGeneratorSnapshot&, Snapshot);
+
 // ---------- Main component: drives the procedural audio ----------
 UCLASS(ClassGroup=Audio, meta=(BlueprintSpawnableComponent))
 class NEWGROOVEGENSYNTH_API UGrooveSynthComponent : public USynthComponent
@@ -61,6 +127,42 @@ public:
 	// Drive extra motion from gameplay (0..1), e.g., player speed
     UFUNCTION(BlueprintCallable, Category="ProcAudio")
     void SetMotionAmount(float Normalized01);
+	// Read all meters in one go (relaxed loads; values are purely visual)
+	UFUNCTION(BlueprintCallable, Category="ProcAudio")
+	FGrooveMeterFrame GetMeters() const;
+
+	// ---- State snapshot ----
+	// Off by default: Start() builds a fresh generator that begins at bar one from Seed.
+	// When true, the running generator publishes its state every block and the next
+	// generator (Start after Stop, source recreated) continues from it in phase.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProcAudio")
+	bool bResumeFromSnapshot = false;
+	// Latest state (published by the running generator, or set by SetSnapshot); false if none
+	UFUNCTION(BlueprintCallable, Category="ProcAudio")
+	bool GetSnapshot(FGrooveGeneratorSnapshot& OutSnapshot) const;
+	// Hand the next generator a stored state (after streaming back in, or to pre-warm).
+	// Applies whether or not bResumeFromSnapshot is set (that flag only controls publishing).
+	// Takes priority over what the running generator publishes, so the intended order is:
+	//   Stop(); SetSnapshot(S); Start();   // or SetSnapshot(S) before the first Start()
+	// Calling it while playing only affects the next Start(); the current sound is unchanged.
+	UFUNCTION(BlueprintCallable, Category="ProcAudio")
+	void SetSnapshot(const FGrooveGeneratorSnapshot& InSnapshot);
+	// Forget the stored state so the next Start() begins fresh: Stop(); ClearSnapshot(); Start();
+	UFUNCTION(BlueprintCallable, Category="ProcAudio")
+	void ClearSnapshot();
+
+	// Last state captured in EndPlay; SaveGame so actor save systems persist it.
+	// Handed back to the generator in BeginPlay when bResumeFromSnapshot is on.
+	UPROPERTY(SaveGame, BlueprintReadOnly, Category = "ProcAudio")
+	FGrooveGeneratorSnapshot SavedSnapshot;
+	// Lets game code stash the state elsewhere (e.g. GameInstance) before a level streams out
+	UPROPERTY(BlueprintAssignable, Category = "ProcAudio")
+	FOnGrooveSnapshotCaptured OnSnapshotCaptured;
+
+	// ---- Offline rendering ----
+	// Generator not attached to an audio device (automation tests, pre-rendering).
+	// Pull audio with OnGenerateAudio on the calling thread.
+	ISoundGeneratorPtr CreateOfflineGenerator(const FSoundGeneratorInitParams& InParams);
 
 protected:
     // ✔ Match your engine: shared pointer + global params
@@ -68,11 +170,25 @@ protected:
 	// In your Engine build, ISoundGeneratorPtr is a TSharedPtr<ISoundGenerator, ThreadSafe>.
     virtual ISoundGeneratorPtr CreateSoundGenerator(const FSoundGeneratorInitParams& InParams) override;
 
+	// Restore SavedSnapshot on load / capture it when leaving the world
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
 	// Motion is set on the game thread and read by the audio thread once per block.
     float Motion = 0.f;
 	// Let the generator access private fields without getters (purely convenience).
 	friend class FGrooveSoundGenerator;  // allows generator to read members
+
+	// Written by the audio thread once per block, read by the next generator / game thread.
+	// Only the newest generator (SnapshotGeneration) may publish, so a generator still
+	// fading out after Stop() can't overwrite state meant for the next one.
+	// bSnapshotOverride: Set/ClearSnapshot was called; publishing is paused until a
+	// new generator consumes it.
+	mutable FCriticalSection SnapshotLock;
+	FGrooveGeneratorSnapshot Snapshot;
+	uint32 SnapshotGeneration = 0;
+	bool bSnapshotOverride = false;
 public:
 	// ---- Lock-free meters used by your visualizer ----
 	// Not UPROPERTY on purpose (atomics aren’t UObjects/GC’d; read from game thread).
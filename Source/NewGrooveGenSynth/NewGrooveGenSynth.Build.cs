@@ -11,6 +11,7 @@ public class NewGrooveGenSynth : ModuleRules
 		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput" });
 
 		PrivateDependencyModuleNames.AddRange(new string[] { "AudioMixer" });   // needed for USoundGenerator
+		PrivateDependencyModuleNames.AddRange(new string[] { "Niagara" });      // meter bridge -> Niagara user parameters
 
 		// Uncomment if you are using Slate UI
 		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
@@ -1,16 +1,17 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
-
+// NewSynthComponent.cpp
 #include "NewSynthComponent.h"
+#include "GrooveMeterSubsystem.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "NiagaraComponent.h"
 
 // Sets default values for this component's properties
 UNewSynthComponent::UNewSynthComponent()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
-
-	// ...
+	// No per-frame tick: UGrooveMeterSubsystem drives all bridges in one batch.
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 
@@ -19,16 +20,62 @@ void UNewSynthComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// ...
-	
+	// Fall back to the groove on our own actor (the usual AProcAudio setup)
+	if (!Groove)
+	{
+		if (AActor* Owner = GetOwner()) Groove = Owner->FindComponentByClass<UGrooveSynthComponent>();
+	}
+
+	if (NiagaraTargets.Num() == 0 && bAutoFindNiagara)
+	{
+		if (AActor* Owner = GetOwner()) Owner->GetComponents<UNiagaraComponent>(NiagaraTargets);
+	}
+
+	// Same order as the fields in FGrooveMeterFrame (see PushMeters)
+	static const TCHAR* Suffixes[NumMeters] = { TEXT("RMS"), TEXT("ArpEnv"), TEXT("PadEnv"), TEXT("PercEnv"), TEXT("Bass"), TEXT("Mid"), TEXT("Treble") };
+	for (int32 i = 0; i < NumMeters; ++i)
+	{
+		ParamNames[i] = FName(*(ParameterPrefix + Suffixes[i]));
+	}
+
+	if (MeterCollection)
+	{
+		if (UWorld* World = GetWorld()) CollectionInstance = World->GetParameterCollectionInstance(MeterCollection);
+	}
+
+	if (UGrooveMeterSubsystem* Meters = UWorld::GetSubsystem<UGrooveMeterSubsystem>(GetWorld()))
+	{
+		Meters->RegisterBridge(this);
+	}
 }
 
+void UNewSynthComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGrooveMeterSubsystem* Meters = UWorld::GetSubsystem<UGrooveMeterSubsystem>(GetWorld()))
+	{
+		Meters->UnregisterBridge(this);
+	}
+	Super::EndPlay(EndPlayReason);
+}
 
-// Called every frame
-void UNewSynthComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UNewSynthComponent::PushMeters(const FGrooveMeterFrame& Frame, bool bWriteCollection)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	const float Values[NumMeters] = { Frame.RMS, Frame.ArpEnv, Frame.PadEnv, Frame.PercEnv, Frame.Bass, Frame.Mid, Frame.Treble };
 
-	// ...
-}
+	// MPC writes only mark the collection dirty; the render-thread upload is
+	// deferred by the world. The subsystem clears bWriteCollection for bridges
+	// whose exact writes another bridge already made this update.
+	if (bWriteCollection)
+	{
+		if (UMaterialParameterCollectionInstance* MPC = CollectionInstance.Get())
+		{
+			for (int32 i = 0; i < NumMeters; ++i) MPC->SetScalarParameterValue(ParamNames[i], Values[i] * Gain);
+		}
+	}
 
+	for (UNiagaraComponent* NC : NiagaraTargets)
+	{
+		if (!NC) continue;
+		for (int32 i = 0; i < NumMeters; ++i) NC->SetVariableFloat(ParamNames[i], Values[i] * Gain);
+	}
+}
@@ -1,28 +1,83 @@
 // Fill out your copyright notice in the Description page of Project Settings.
-
+// NewSynthComponent.h
 #pragma once
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "GrooveSynthComponent.h"  // FGrooveMeterFrame
 #include "NewSynthComponent.generated.h"
 
+class UMaterialParameterCollection;
+class UMaterialParameterCollectionInstance;
+class UNiagaraComponent;
 
-UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+/**
+ * UNewSynthComponent
+ * ------------------
+ * Meter bridge: forwards a groove's meters to a Material Parameter Collection
+ * and/or Niagara user parameters.
+ * - Does NOT tick. It registers with UGrooveMeterSubsystem, which reads every
+ *   groove's meters once per update and pushes them to all bridges in one batch.
+ * - Parameter names are Prefix + {RMS, ArpEnv, PadEnv, PercEnv, Bass, Mid, Treble}.
+ */
+UCLASS( ClassGroup=(Audio), meta=(BlueprintSpawnableComponent) )
 class NEWGROOVEGENSYNTH_API UNewSynthComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
-public:	
+public:
 	// Sets default values for this component's properties
 	UNewSynthComponent();
 
+	/** Groove to listen to. Set from Blueprint (components can't be picked in Details);
+		if left empty, the first one on the owning actor is used. */
+	UPROPERTY(BlueprintReadWrite, Category = "ProcAudio")
+	UGrooveSynthComponent* Groove = nullptr;
+
+	/** Collection that receives the meters as scalar parameters (optional). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProcAudio")
+	UMaterialParameterCollection* MeterCollection = nullptr;
+
+	/** Niagara systems that receive the meters as float user parameters (optional).
+		Set from Blueprint (components can't be picked in Details); see bAutoFindNiagara. */
+	UPROPERTY(BlueprintReadWrite, Category = "ProcAudio")
+	TArray<UNiagaraComponent*> NiagaraTargets;
+
+	/** If NiagaraTargets is empty at BeginPlay, use every Niagara component on the owner. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProcAudio")
+	bool bAutoFindNiagara = true;
+
+	/** Prepended to each parameter name, e.g. "Groove" -> "GrooveRMS". */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProcAudio")
+	FString ParameterPrefix = TEXT("Groove");
+
+	/** Scale applied to every meter before it is written. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProcAudio", meta = (ClampMin = "0.0"))
+	float Gain = 1.f;
+
+	/** Called by UGrooveMeterSubsystem with the meters it read this update.
+		bWriteCollection = false when an identical MPC write was already made. */
+	void PushMeters(const FGrooveMeterFrame& Frame, bool bWriteCollection);
+
+	/** What this bridge writes into its collection: same key => same 7 scalar writes. */
+	using FCollectionWriteKey = TTuple<const UMaterialParameterCollectionInstance*, const UGrooveSynthComponent*, FName, float>;
+	FCollectionWriteKey GetCollectionWriteKey() const
+	{
+		return MakeTuple(static_cast<const UMaterialParameterCollectionInstance*>(CollectionInstance.Get()),
+			static_cast<const UGrooveSynthComponent*>(Groove), ParamNames[0], Gain);
+	}
+
 protected:
-	// Called when the game starts
+	// Called when the game starts: resolve targets and register with the manager
 	virtual void BeginPlay() override;
+	// Unregister so the manager never touches a dead bridge
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-public:	
-	// Called every frame
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+private:
+	// Names are built once in BeginPlay (FName construction is not free per frame)
+	static constexpr int32 NumMeters = 7;
+	FName ParamNames[NumMeters];
 
-		
+	// Cached per-world collection instance (resolved once, reused every update)
+	TWeakObjectPtr<UMaterialParameterCollectionInstance> CollectionInstance;
 };
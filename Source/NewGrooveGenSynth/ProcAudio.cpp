@@ -37,6 +37,7 @@ void AProcAudio::BeginPlay()
 
 	// Start the synth the first time play begins.
 	// This constructs the ISoundGenerator and starts pulling audio buffers.
+	// Fresh from Seed by default; with Synth->bResumeFromSnapshot it continues from the last snapshot.
 	if (Synth && !Synth->IsPlaying()) Synth->Start();  // this will spawn the FGrooveSoundGenerator
 
 	// ---- Keyboard control without a Pawn/Character ----
@@ -0,0 +1,379 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+// GrooveRenderTests.cpp
+// Golden-render (bit-accuracy) and performance checks for FGrooveSoundGenerator.
+// Runs headless:
+//   UnrealEditor-Cmd NewGrooveGenSynth.uproject -nullrhi -unattended
+//     -ExecCmds="Automation RunTests NewGrooveGenSynth.Groove; Quit"
+// Add -GrooveRecordGolden to (re)write the golden CRCs (Config/GrooveRenderGolden.csv,
+// shared) and this machine's perf baseline (Saved/Automation/, machine-local).
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "GrooveSynthComponent.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/CommandLine.h"
+#include "HAL/PlatformProcess.h"
+#include "UObject/Package.h"
+
+namespace GrooveRenderTests
+{
+	// Fixed block size so results don't depend on the device callback size
+	constexpr int32 BlockFrames  = 1024;
+	constexpr float ClipSeconds  = 4.f;
+	constexpr int32 WarmupBlocks = 8;     // settle caches / branch predictors before timing
+	constexpr int32 TimedRuns    = 5;     // median of these is compared to the baseline
+	constexpr double kPerfTolerance = 1.25;  // median may be up to 25% over this machine's baseline
+
+	/** One row of Config/GrooveRenderGolden.csv */
+	struct FCase
+	{
+		int32 Seed = 12345;
+		int32 Scale = 0;
+		float BPM = 100.f;
+		int32 Channels = 2;
+		int32 SampleRate = 48000;
+		TOptional<uint32> Crc;         // unset = not recorded yet
+
+		FString Describe() const
+		{
+			return FString::Printf(TEXT("seed=%d scale=%d bpm=%.1f ch=%d sr=%d"), Seed, Scale, BPM, Channels, SampleRate);
+		}
+	};
+
+	FString GoldenPath() { return FPaths::ProjectConfigDir() / TEXT("GrooveRenderGolden.csv"); }
+
+	// Timing depends on the hardware, so baselines are per machine and never shared
+	FString PerfBaselinePath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("Automation") / FString::Printf(TEXT("GrooveRenderPerf-%s.csv"), FPlatformProcess::ComputerName());
+	}
+
+	bool IsRecording() { return FParse::Param(FCommandLine::Get(), TEXT("GrooveRecordGolden")); }
+
+	// Header comment lines are kept as-is so recording doesn't lose them
+	bool LoadCases(TArray<FCase>& OutCases, TArray<FString>& OutHeader)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *GoldenPath())) return false;
+
+		for (const FString& Line : Lines)
+		{
+			if (Line.IsEmpty() || Line.StartsWith(TEXT(";"))) { OutHeader.Add(Line); continue; }
+
+			TArray<FString> F;
+			Line.ParseIntoArray(F, TEXT(","), /*InCullEmpty*/ false);
+			if (F.Num() < 5) continue;
+
+			FCase C;
+			C.Seed       = FCString::Atoi(*F[0]);
+			C.Scale      = FMath::Clamp(FCString::Atoi(*F[1]), 0, 3);
+			C.BPM        = FCString::Atof(*F[2]);
+			C.Channels   = FMath::Clamp(FCString::Atoi(*F[3]), 1, 8);
+			C.SampleRate = FCString::Atoi(*F[4]);
+			if (F.IsValidIndex(5) && !F[5].TrimStartAndEnd().IsEmpty()) C.Crc = static_cast<uint32>(FCString::Strtoui64(*F[5], nullptr, 16));
+			OutCases.Add(C);
+		}
+		return true;
+	}
+
+	bool SaveCases(const TArray<FCase>& Cases, const TArray<FString>& Header)
+	{
+		TArray<FString> Lines = Header;
+		for (const FCase& C : Cases)
+		{
+			Lines.Add(FString::Printf(TEXT("%d,%d,%g,%d,%d,%s"), C.Seed, C.Scale, C.BPM, C.Channels, C.SampleRate,
+				C.Crc.IsSet() ? *FString::Printf(TEXT("%08X"), C.Crc.GetValue()) : TEXT("")));
+		}
+		return FFileHelper::SaveStringArrayToFile(Lines, *GoldenPath());
+	}
+
+	// Machine-local baselines: "<case description>,<ns/frame>" per line
+	TMap<FString, double> LoadPerfBaselines()
+	{
+		TMap<FString, double> Baselines;
+		TArray<FString> Lines;
+		FFileHelper::LoadFileToStringArray(Lines, *PerfBaselinePath());   // missing file = no baselines yet
+		for (const FString& Line : Lines)
+		{
+			FString Key, Value;
+			if (Line.Split(TEXT(","), &Key, &Value, ESearchCase::CaseSensitive, ESearchDir::FromEnd)) Baselines.Add(Key, FCString::Atod(*Value));
+		}
+		return Baselines;
+	}
+
+	bool SavePerfBaselines(const TMap<FString, double>& Baselines)
+	{
+		TArray<FString> Lines;
+		for (const TPair<FString, double>& B : Baselines) Lines.Add(FString::Printf(TEXT("%s,%.1f"), *B.Key, B.Value));
+		return FFileHelper::SaveStringArrayToFile(Lines, *PerfBaselinePath());
+	}
+
+	// Transient host so the generator reads parameters through its normal path
+	UGrooveSynthComponent* MakeHost(const FCase& C, bool bResume)
+	{
+		UGrooveSynthComponent* Host = NewObject<UGrooveSynthComponent>(GetTransientPackage());
+		Host->Seed  = C.Seed;
+		Host->Scale = static_cast<EProcScale>(C.Scale);
+		Host->BPM   = C.BPM;
+		Host->bResumeFromSnapshot = bResume;
+		return Host;
+	}
+
+	ISoundGeneratorPtr MakeGenerator(UGrooveSynthComponent* Host, const FCase& C)
+	{
+		FSoundGeneratorInitParams Init;
+		Init.SampleRate  = C.SampleRate;
+		Init.NumChannels = C.Channels;
+		return Host->CreateOfflineGenerator(Init);
+	}
+
+	int32 NumClipFrames(const FCase& C)
+	{
+		return FMath::CeilToInt(ClipSeconds * C.SampleRate / BlockFrames) * BlockFrames;
+	}
+
+	// Full clip from a fresh generator (default settings) -> CRC of the raw samples
+	uint32 RenderCrc(const FCase& C)
+	{
+		UGrooveSynthComponent* Host = MakeHost(C, /*bResume*/ false);
+		ISoundGeneratorPtr Gen = MakeGenerator(Host, C);
+
+		const int32 NumFrames = NumClipFrames(C);
+		TArray<float> Out;
+		Out.SetNumZeroed(NumFrames * C.Channels);
+		for (int32 Frame = 0; Frame < NumFrames; Frame += BlockFrames)
+		{
+			Gen->OnGenerateAudio(Out.GetData() + Frame * C.Channels, BlockFrames * C.Channels);
+		}
+		return FCrc::MemCrc32(Out.GetData(), Out.Num() * sizeof(float));
+	}
+
+	// Median ns/frame over TimedRuns clips, after WarmupBlocks untimed blocks
+	double MeasureNsPerFrame(const FCase& C, bool bResume)
+	{
+		UGrooveSynthComponent* Host = MakeHost(C, bResume);
+		ISoundGeneratorPtr Gen = MakeGenerator(Host, C);
+
+		TArray<float> Block;
+		Block.SetNumZeroed(BlockFrames * C.Channels);
+		for (int32 i = 0; i < WarmupBlocks; ++i) Gen->OnGenerateAudio(Block.GetData(), Block.Num());
+
+		const int32 NumFrames = NumClipFrames(C);
+		TArray<double> Runs;
+		for (int32 Run = 0; Run < TimedRuns; ++Run)
+		{
+			const double Start = FPlatformTime::Seconds();
+			for (int32 Frame = 0; Frame < NumFrames; Frame += BlockFrames)
+			{
+				Gen->OnGenerateAudio(Block.GetData(), Block.Num());
+			}
+			Runs.Add((FPlatformTime::Seconds() - Start) * 1e9 / NumFrames);
+		}
+		Runs.Sort();
+		return Runs[Runs.Num() / 2];
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Bit-accuracy: same config must render the same samples, run to run and vs golden
+// ---------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGrooveRenderGoldenTest, "NewGrooveGenSynth.Groove.RenderGolden",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGrooveRenderGoldenTest::RunTest(const FString& Parameters)
+{
+	using namespace GrooveRenderTests;
+
+	TArray<FCase> Cases;
+	TArray<FString> Header;
+	if (!LoadCases(Cases, Header) || Cases.Num() == 0)
+	{
+		AddError(FString::Printf(TEXT("No golden cases in %s"), *GoldenPath()));
+		return false;
+	}
+
+	const bool bRecord = IsRecording();
+	for (FCase& C : Cases)
+	{
+		const uint32 Crc = RenderCrc(C);
+
+		// Two fresh generators with the same Seed must agree regardless of golden data
+		const uint32 Again = RenderCrc(C);
+		if (Crc != Again)
+		{
+			AddError(FString::Printf(TEXT("%s: non-deterministic render (%08X vs %08X)"), *C.Describe(), Crc, Again));
+		}
+
+		if (bRecord)
+		{
+			C.Crc = Crc;
+			AddInfo(FString::Printf(TEXT("%s: recorded crc %08X"), *C.Describe(), Crc));
+		}
+		else if (!C.Crc.IsSet())
+		{
+			// Not recorded yet: skip rather than fail (run-to-run determinism is still checked above)
+			AddWarning(FString::Printf(TEXT("%s: no golden crc (got %08X), skipped; record with -GrooveRecordGolden"), *C.Describe(), Crc));
+		}
+		else if (C.Crc.GetValue() != Crc)
+		{
+			AddError(FString::Printf(TEXT("%s: crc %08X != golden %08X"), *C.Describe(), Crc, C.Crc.GetValue()));
+		}
+	}
+
+	if (bRecord && !SaveCases(Cases, Header))
+	{
+		AddError(FString::Printf(TEXT("Could not write %s"), *GoldenPath()));
+	}
+	return !HasAnyErrors();
+}
+
+// ---------------------------------------------------------------------------
+// Snapshot resume: a restart must continue in phase, bit-identical to no restart
+// ---------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGrooveSnapshotResumeTest, "NewGrooveGenSynth.Groove.SnapshotResume",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGrooveSnapshotResumeTest::RunTest(const FString& Parameters)
+{
+	using namespace GrooveRenderTests;
+
+	TArray<FCase> Cases;
+	TArray<FString> Header;
+	if (!LoadCases(Cases, Header) || Cases.Num() == 0)
+	{
+		AddError(FString::Printf(TEXT("No golden cases in %s"), *GoldenPath()));
+		return false;
+	}
+
+	for (const FCase& C : Cases)
+	{
+		const int32 NumFrames = NumClipFrames(C);
+		const int32 SplitFrame = (NumFrames / BlockFrames / 2) * BlockFrames;  // stop halfway, on a block edge
+
+		auto Render = [&C](ISoundGenerator& Gen, TArray<float>& Out, int32 FromFrame, int32 ToFrame)
+		{
+			for (int32 Frame = FromFrame; Frame < ToFrame; Frame += BlockFrames)
+			{
+				Gen.OnGenerateAudio(Out.GetData() + Frame * C.Channels, BlockFrames * C.Channels);
+			}
+		};
+
+		// Reference: one generator, uninterrupted
+		TArray<float> Expected;
+		Expected.SetNumZeroed(NumFrames * C.Channels);
+		{
+			ISoundGeneratorPtr Gen = MakeGenerator(MakeHost(C, /*bResume*/ false), C);
+			Render(*Gen, Expected, 0, NumFrames);
+		}
+
+		// Restart on the same host: second generator resumes from the published snapshot
+		TArray<float> Resumed;
+		Resumed.SetNumZeroed(NumFrames * C.Channels);
+		UGrooveSynthComponent* Host = MakeHost(C, /*bResume*/ true);
+		{
+			ISoundGeneratorPtr First = MakeGenerator(Host, C);
+			Render(*First, Resumed, 0, SplitFrame);
+		}
+		{
+			ISoundGeneratorPtr Second = MakeGenerator(Host, C);
+			Render(*Second, Resumed, SplitFrame, NumFrames);
+		}
+		if (FMemory::Memcmp(Expected.GetData(), Resumed.GetData(), Expected.Num() * sizeof(float)) != 0)
+		{
+			AddError(FString::Printf(TEXT("%s: resume via bResumeFromSnapshot drifted from uninterrupted render"), *C.Describe()));
+		}
+
+		// Explicit SetSnapshot on a fresh host applies even with bResumeFromSnapshot off (pre-warm)
+		FGrooveGeneratorSnapshot Snap;
+		TArray<float> Handed;
+		Handed.SetNumZeroed(NumFrames * C.Channels);
+		{
+			UGrooveSynthComponent* First = MakeHost(C, /*bResume*/ true);
+			ISoundGeneratorPtr Gen = MakeGenerator(First, C);
+			Render(*Gen, Handed, 0, SplitFrame);
+			if (!First->GetSnapshot(Snap))
+			{
+				AddError(FString::Printf(TEXT("%s: no snapshot published"), *C.Describe()));
+				continue;
+			}
+		}
+		{
+			UGrooveSynthComponent* Other = MakeHost(C, /*bResume*/ false);
+			Other->SetSnapshot(Snap);
+			ISoundGeneratorPtr Gen = MakeGenerator(Other, C);
+			Render(*Gen, Handed, SplitFrame, NumFrames);
+		}
+		if (FMemory::Memcmp(Expected.GetData(), Handed.GetData(), Expected.Num() * sizeof(float)) != 0)
+		{
+			AddError(FString::Printf(TEXT("%s: resume via SetSnapshot drifted from uninterrupted render"), *C.Describe()));
+		}
+	}
+	return !HasAnyErrors();
+}
+
+// ---------------------------------------------------------------------------
+// Performance: median ns/frame vs this machine's baseline, with and without snapshot publishing
+// ---------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGrooveRenderPerfTest, "NewGrooveGenSynth.Groove.RenderPerf",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FGrooveRenderPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace GrooveRenderTests;
+
+	TArray<FCase> Cases;
+	TArray<FString> Header;
+	if (!LoadCases(Cases, Header) || Cases.Num() == 0)
+	{
+		AddError(FString::Printf(TEXT("No golden cases in %s"), *GoldenPath()));
+		return false;
+	}
+
+	const bool bRecord = IsRecording();
+	TMap<FString, double> Baselines = LoadPerfBaselines();
+	for (const FCase& C : Cases)
+	{
+		// Default settings, plus the bResumeFromSnapshot path (per-block TryLock + copy)
+		const double Ns       = MeasureNsPerFrame(C, /*bResume*/ false);
+		const double NsResume = MeasureNsPerFrame(C, /*bResume*/ true);
+		AddInfo(FString::Printf(TEXT("%s: %.1f ns/frame (resume on: %.1f)"), *C.Describe(), Ns, NsResume));
+
+		if (bRecord)
+		{
+			Baselines.Add(C.Describe(), Ns);
+			continue;
+		}
+
+		// Only enforce limits against a baseline recorded on this machine
+		const double* Baseline = Baselines.Find(C.Describe());
+		if (!Baseline)
+		{
+			AddWarning(FString::Printf(TEXT("%s: no ns/frame baseline for this machine, skipped; record with -GrooveRecordGolden"), *C.Describe()));
+			continue;
+		}
+
+		const double Limit = *Baseline * kPerfTolerance;
+		if (Ns > Limit)
+		{
+			AddError(FString::Printf(TEXT("%s: %.1f ns/frame exceeds baseline %.1f (+%.0f%%)"),
+				*C.Describe(), Ns, *Baseline, (kPerfTolerance - 1.0) * 100.0));
+		}
+		if (NsResume > Limit)
+		{
+			AddError(FString::Printf(TEXT("%s: %.1f ns/frame with bResumeFromSnapshot exceeds baseline %.1f (+%.0f%%)"),
+				*C.Describe(), NsResume, *Baseline, (kPerfTolerance - 1.0) * 100.0));
+		}
+	}
+
+	if (bRecord && !SavePerfBaselines(Baselines))
+	{
+		AddError(FString::Printf(TEXT("Could not write %s"), *PerfBaselinePath()));
+	}
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS